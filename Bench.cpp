@@ -0,0 +1,423 @@
+// Bench.cpp - Othello engine micro-benchmarks
+// Written by Paul Jang
+
+// including various necessary files
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Othello.h"
+#include "Search.h"
+#include "Bitboard.h"
+#include "Random.h"
+
+using namespace std;
+
+
+#define SAMPLES		21			// default number of timed samples per benchmark
+#define MIN_SAMPLE_NS	10000000	// each sample runs for at least 10ms
+
+// a fixed mid-game position, stored row by row, with the side to move
+struct Position
+{
+	const char* rows[ROWS];
+	char toMove;
+};
+
+// the benchmark corpus, taken from random games between 21 and 48 discs
+// the positions must never change, otherwise results can't be compared between commits
+static const Position corpus[] =
+{
+	// 21 discs, white to move
+	{ { "--------", "---wb---", "---wb---", "---bw---", "--bwbwbb", "--w-wbb-", "-w---bb-", "w---b---" }, 'w' },
+	// 24 discs, black to move
+	{ { "--------", "-----b--", "-bbwbb--", "--bbwbb-", "--bbb---", "--wbw---", "--w-wwb-", "--w-w-w-" }, 'b' },
+	// 27 discs, white to move
+	{ { "--------", "-www----", "---b----", "b-wwwwww", "-bwww-b-", "-bbwbbb-", "---bb-w-", "--b-w---" }, 'w' },
+	// 30 discs, black to move
+	{ { "--------", "---bb---", "---bww--", "--bbw-b-", "---bbb--", "--bwwbb-", "wwwbwbb-", "bbb-bw-b" }, 'b' },
+	// 33 discs, white to move
+	{ { "--------", "--wb----", "--bwww--", "-bwww---", "bb-wbwww", "-bwwbbwb", "-b-wbbw-", "-b-bbw--" }, 'w' },
+	// 36 discs, black to move
+	{ { "-bbbbb--", "-w-b---w", "--wbwwww", "-wbbwwww", "wbbbwwww", "---wbb-w", "----w---", "---b-w--" }, 'b' },
+	// 39 discs, white to move
+	{ { "--b-bw--", "-wbbbw--", "w-b-bwb-", "bbbbbbb-", "bbwwwbb-", "-bwbbbb-", "-bb-b---", "b--bw---" }, 'w' },
+	// 42 discs, black to move
+	{ { "--wb----", "-wwwb---", "--wwwbb-", "-wbbwbbw", "wwwwb-ww", "--bbbbww", "wbwbw-b-", "b--bbw-b" }, 'b' },
+	// 45 discs, white to move
+	{ { "---b--b-", "-wwb-b--", "b-wwww-w", "wbwwwbbb", "wwbbwwb-", "wwwbwbwb", "wwwbbwww", "---b--w-" }, 'w' },
+	// 48 discs, black to move
+	{ { "----b-w-", "bbbb-bww", "w-bbb-w-", "wwbwbbwb", "-wwbbbwb", "bwwwbwwb", "wwwwwbw-", "--b-bbb-" }, 'b' },
+};
+
+#define CORPUS_SIZE	(int)(sizeof(corpus) / sizeof(corpus[0]))
+
+// a legal move in one of the corpus positions
+struct CorpusMove
+{
+	int position;
+	int row;
+	int col;
+};
+
+// the corpus unpacked into game boards, plus every legal move of every position
+static char boards[CORPUS_SIZE][ROWS][COLS];
+static vector<CorpusMove> moves;
+
+// the corpus as bitboards, the side to move first
+static Bitboard mine[CORPUS_SIZE];
+static Bitboard theirs[CORPUS_SIZE];
+
+// results are accumulated here so the compiler can't discard the measured work
+// unsigned, so the running sum wraps instead of overflowing
+static volatile unsigned long sink = 0;
+
+
+// unpacks the corpus into boards and collects the legal moves of each position
+void loadCorpus()
+{
+	vector<int> legalRows; vector<int> legalCols;
+	vector<int> seenRows; vector<int> seenCols;
+
+	for(int p=0; p<CORPUS_SIZE; p++)
+	{
+		for(int r=0; r<ROWS; r++)
+		{
+			memcpy(boards[p][r], corpus[p].rows[r], COLS);
+		}
+		toBitboards(boards[p],corpus[p].toMove,mine[p],theirs[p]);
+
+		legalRows.clear(); legalCols.clear();
+		seenRows.clear(); seenCols.clear();
+		listMovesAI(boards[p],legalRows,legalCols,corpus[p].toMove);
+
+		// listMovesAI reports a square once per flanking direction, so duplicates are dropped
+		for(unsigned int i=0; i<legalRows.size(); i++)
+		{
+			if(checkMove(seenRows,seenCols,legalRows[i],legalCols[i]))
+				continue;
+			seenRows.push_back(legalRows[i]);
+			seenCols.push_back(legalCols[i]);
+
+			CorpusMove move = { p, legalRows[i], legalCols[i] };
+			moves.push_back(move);
+		}
+	}
+}
+
+
+// each benchmark runs (passes) times over its inputs and returns the number of operations done
+
+// legal move generation through the AI path
+long benchListMoves(long passes)
+{
+	vector<int> legalRows; vector<int> legalCols;
+	legalRows.reserve(64); legalCols.reserve(64);
+
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			legalRows.clear(); legalCols.clear();
+			listMovesAI(boards[p],legalRows,legalCols,corpus[p].toMove);
+			sink += (long)legalRows.size();
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// copying a board, the baseline cost included in the flip benchmark
+long benchCopy(long passes)
+{
+	char scratch[ROWS][COLS];
+
+	for(long n=0; n<passes; n++)
+	{
+		for(unsigned int i=0; i<moves.size(); i++)
+		{
+			memcpy(scratch,boards[moves[i].position],sizeof(scratch));
+			sink += scratch[moves[i].row][moves[i].col];
+		}
+	}
+	return passes * (long)moves.size();
+}
+
+// playing one legal move onto a fresh copy of its position
+long benchFlip(long passes)
+{
+	char scratch[ROWS][COLS];
+	int row; int col;
+
+	for(long n=0; n<passes; n++)
+	{
+		for(unsigned int i=0; i<moves.size(); i++)
+		{
+			memcpy(scratch,boards[moves[i].position],sizeof(scratch));
+			row = moves[i].row; col = moves[i].col;
+			flipDiscs(scratch,row,col,corpus[moves[i].position].toMove);
+			sink += scratch[3][3];
+		}
+	}
+	return passes * (long)moves.size();
+}
+
+// counting the discs of one color
+long benchCountPieces(long passes)
+{
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			sink += countPieces(boards[p],corpus[p].toMove);
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// counting all discs on the board
+long benchTotalPieces(long passes)
+{
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			sink += totalPieces(boards[p]);
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// static evaluation of a position for the side to move
+long benchEvaluate(long passes)
+{
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			sink += evaluate(boards[p],corpus[p].toMove);
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// stable disc flood-fill for the side to move
+long benchStableDiscs(long passes)
+{
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			sink += popCount(stableDiscs(mine[p],theirs[p]));
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// frontier discs and potential mobility for the side to move
+long benchFrontier(long passes)
+{
+	for(long n=0; n<passes; n++)
+	{
+		for(int p=0; p<CORPUS_SIZE; p++)
+		{
+			sink += popCount(frontierDiscs(mine[p],theirs[p])) + popCount(potentialMobility(mine[p],theirs[p]));
+		}
+	}
+	return passes * CORPUS_SIZE;
+}
+
+// picking a random move index, as the AI players do every turn
+long benchRandom(long passes)
+{
+	Random rng(2026);
+
+	for(long n=0; n<passes; n++)
+	{
+		for(unsigned int i=0; i<moves.size(); i++)
+		{
+			sink += rng.nextInt(i + 1);
+		}
+	}
+	return passes * (long)moves.size();
+}
+
+// making a move in place and then undoing it, as a search does at every node
+long benchMakeUnmake(long passes)
+{
+	char undo[ROWS][COLS];
+	int row; int col;
+
+	for(long n=0; n<passes; n++)
+	{
+		for(unsigned int i=0; i<moves.size(); i++)
+		{
+			char (*board)[COLS] = boards[moves[i].position];
+			row = moves[i].row; col = moves[i].col;
+
+			// make
+			memcpy(undo,board,sizeof(undo));
+			flipDiscs(board,row,col,corpus[moves[i].position].toMove);
+			sink += board[3][3];
+
+			// unmake
+			memcpy(board,undo,sizeof(undo));
+		}
+	}
+	return passes * (long)moves.size();
+}
+
+
+// a benchmark entry, its name and the function it times
+struct Benchmark
+{
+	const char* name;
+	long (*run)(long passes);
+};
+
+// every benchmark, in the order they are run and reported
+static const Benchmark benchmarks[] =
+{
+	{ "listMovesAI", benchListMoves },
+	{ "boardCopy", benchCopy },
+	{ "flipDiscs", benchFlip },
+	{ "countPieces", benchCountPieces },
+	{ "totalPieces", benchTotalPieces },
+	{ "evaluate", benchEvaluate },
+	{ "stableDiscs", benchStableDiscs },
+	{ "frontier", benchFrontier },
+	{ "randomMove", benchRandom },
+	{ "makeUnmake", benchMakeUnmake },
+};
+
+#define BENCHMARK_COUNT	(int)(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+// the measured statistics of a benchmark, all in nanoseconds per operation
+struct Result
+{
+	long passes;
+	long ops;
+	double mean;
+	double stddev;
+	double median;
+	double min;
+	double max;
+};
+
+// runs a benchmark once and returns the elapsed nanoseconds
+// Parameters: (bench) - the benchmark to run
+// (result) - holds the pass count, and receives the operation count
+double timeOnce(const Benchmark& bench, Result& result)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	result.ops = bench.run(result.passes);
+	chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+	return (double)chrono::duration_cast<chrono::nanoseconds>(stop - start).count();
+}
+
+// calibrates the pass count, then takes the timed samples and computes their statistics
+// Parameters: (bench) - the benchmark to measure
+// (result) - receives the statistics
+// (samples) - the number of timed samples to take
+void measure(const Benchmark& bench, Result& result, int samples)
+{
+	vector<double> perOp;
+
+	// doubles the pass count until one sample is long enough to time reliably
+	result.passes = 1;
+	while(timeOnce(bench,result) < MIN_SAMPLE_NS)
+		result.passes *= 2;
+
+	for(int s=0; s<samples; s++)
+	{
+		perOp.push_back(timeOnce(bench,result) / result.ops);
+	}
+
+	sort(perOp.begin(),perOp.end());
+	result.min = perOp.front();
+	result.max = perOp.back();
+	// an even count has two middle samples, the median is halfway between them
+	if(perOp.size() % 2 == 0)
+		result.median = (perOp[perOp.size() / 2 - 1] + perOp[perOp.size() / 2]) / 2;
+	else
+		result.median = perOp[perOp.size() / 2];
+
+	result.mean = 0;
+	for(unsigned int i=0; i<perOp.size(); i++)
+		result.mean += perOp[i];
+	result.mean /= perOp.size();
+
+	result.stddev = 0;
+	for(unsigned int i=0; i<perOp.size(); i++)
+		result.stddev += (perOp[i] - result.mean) * (perOp[i] - result.mean);
+	result.stddev = sqrt(result.stddev / perOp.size());
+}
+
+
+// runs every benchmark and reports ns per op, as a table or as JSON with --json
+// Usage: Bench [--json] [--samples N]
+int main(int argc, char* argv[])
+{
+	bool json = false; int samples = SAMPLES;
+
+	vector<Result> results(BENCHMARK_COUNT);
+
+	for(int i=1; i<argc; i++)
+	{
+		if(strcmp(argv[i],"--json") == 0)
+			json = true;
+		else if(strcmp(argv[i],"--samples") == 0 && i+1 < argc)
+			samples = max(1,atoi(argv[++i]));
+		else
+		{
+			cerr << "Usage: " << argv[0] << " [--json] [--samples N]" << endl;
+			return 1;
+		}
+	}
+
+	loadCorpus();
+
+	for(int i=0; i<BENCHMARK_COUNT; i++)
+	{
+		measure(benchmarks[i],results[i],samples);
+	}
+
+	// one JSON object per run, so results can be stored and diffed between commits
+	if(json)
+	{
+		cout << fixed << setprecision(3);
+		cout << "{\"positions\":" << CORPUS_SIZE << ",\"moves\":" << moves.size()
+			 << ",\"samples\":" << samples << ",\"unit\":\"ns/op\",\"benchmarks\":[";
+		for(int i=0; i<BENCHMARK_COUNT; i++)
+		{
+			cout << (i ? "," : "") << "{\"name\":\"" << benchmarks[i].name << "\""
+				 << ",\"ops\":" << results[i].ops
+				 << ",\"mean\":" << results[i].mean << ",\"stddev\":" << results[i].stddev
+				 << ",\"median\":" << results[i].median
+				 << ",\"min\":" << results[i].min << ",\"max\":" << results[i].max << "}";
+		}
+		cout << "]}" << endl;
+	}
+
+	// otherwise a table for reading in the terminal
+	else
+	{
+		cout << "Corpus : " << CORPUS_SIZE << " positions, " << moves.size() << " moves, "
+			 << samples << " samples per benchmark" << endl << endl;
+		cout << left << setw(14) << "benchmark" << right << setw(12) << "mean ns/op"
+			 << setw(10) << "stddev" << setw(10) << "median" << setw(10) << "min" << setw(10) << "max" << endl;
+		cout << fixed << setprecision(2);
+		for(int i=0; i<BENCHMARK_COUNT; i++)
+		{
+			cout << left << setw(14) << benchmarks[i].name << right << setw(12) << results[i].mean
+				 << setw(10) << results[i].stddev << setw(10) << results[i].median
+				 << setw(10) << results[i].min << setw(10) << results[i].max << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,186 @@
+// Bitboard.cpp - Othello bitboard definitions
+// Written by Paul Jang
+
+// including various necessary files
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include "Bitboard.h"
+
+
+#define FILE_A	0x0101010101010101ULL	// column 0
+#define FILE_H	0x8080808080808080ULL	// column 7
+#define RANK_1	0x00000000000000ffULL	// row 0
+#define RANK_8	0xff00000000000000ULL	// row 7
+#define BORDER	(FILE_A | FILE_H | RANK_1 | RANK_8)
+
+// single step shifts, masked so nothing wraps around to the other side of the board
+static inline Bitboard shiftN(Bitboard b)	{ return b >> 8; }
+static inline Bitboard shiftS(Bitboard b)	{ return b << 8; }
+static inline Bitboard shiftE(Bitboard b)	{ return (b << 1) & ~FILE_A; }
+static inline Bitboard shiftW(Bitboard b)	{ return (b >> 1) & ~FILE_H; }
+static inline Bitboard shiftNE(Bitboard b)	{ return (b >> 7) & ~FILE_A; }
+static inline Bitboard shiftNW(Bitboard b)	{ return (b >> 9) & ~FILE_H; }
+static inline Bitboard shiftSE(Bitboard b)	{ return (b << 9) & ~FILE_A; }
+static inline Bitboard shiftSW(Bitboard b)	{ return (b << 7) & ~FILE_H; }
+
+
+// splits the board into the discs of one color and the discs of the other
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the color whose discs go in (mine)
+// (mine + theirs) - the bitboards being filled
+void toBitboards(char gameBoard[ROWS][COLS], char color, Bitboard& mine, Bitboard& theirs)
+{
+	mine = theirs = 0;
+
+	for(int r=0; r<ROWS; r++)
+	{
+		for(int c=0; c<COLS; c++)
+		{
+			if(gameBoard[r][c] == '-')
+				continue;
+			if(gameBoard[r][c] == color)
+				mine |= 1ULL << (r * COLS + c);
+			else
+				theirs |= 1ULL << (r * COLS + c);
+		}
+	}
+}
+
+
+// counts the set bits of a bitboard
+// Parameter : (bits) - the bitboard to count
+int popCount(Bitboard bits)
+{
+#ifdef _MSC_VER
+	return (int)__popcnt64(bits);
+#else
+	return __builtin_popcountll(bits);
+#endif
+}
+
+
+// returns every square next to one of the given squares, in any of the eight directions
+// Parameter : (bits) - the squares to spread out from
+Bitboard neighbors(Bitboard bits)
+{
+	return shiftN(bits) | shiftS(bits) | shiftE(bits) | shiftW(bits)
+		| shiftNE(bits) | shiftNW(bits) | shiftSE(bits) | shiftSW(bits);
+}
+
+
+// the fifteen diagonals in each direction
+struct DiagonalMasks
+{
+	Bitboard diagonals[15];
+	Bitboard antidiagonals[15];
+
+	// grows each diagonal from its square on the top row or on the left or right column
+	DiagonalMasks()
+	{
+		for(int i=0; i<15; i++)
+		{
+			// down and to the right, from the top row or the left column
+			Bitboard start = (i < 8) ? (1ULL << i) : (1ULL << ((i - 7) * 8));
+			diagonals[i] = start;
+			for(Bitboard step = shiftSE(start); step; step = shiftSE(step))
+				diagonals[i] |= step;
+
+			// down and to the left, from the top row or the right column
+			start = (i < 8) ? (1ULL << i) : (1ULL << ((i - 7) * 8 + 7));
+			antidiagonals[i] = start;
+			for(Bitboard step = shiftSW(start); step; step = shiftSW(step))
+				antidiagonals[i] |= step;
+		}
+	}
+};
+
+// returns the diagonal masks, built once on first use
+static const DiagonalMasks& diagonalMasks()
+{
+	static const DiagonalMasks masks;
+	return masks;
+}
+
+
+// returns the squares on completely filled lines, for each of the four line directions
+// Parameters: (occupied) - every disc on the board
+// (rows + cols + diagonals + antidiagonals) - the filled squares of each kind of line
+static void filledLines(Bitboard occupied, Bitboard& rows, Bitboard& cols, Bitboard& diagonals, Bitboard& antidiagonals)
+{
+	const DiagonalMasks& masks = diagonalMasks();
+	Bitboard line;
+
+	rows = cols = diagonals = antidiagonals = 0;
+
+	for(int i=0; i<8; i++)
+	{
+		line = RANK_1 << (8 * i);
+		if((occupied & line) == line)
+			rows |= line;
+
+		line = FILE_A << i;
+		if((occupied & line) == line)
+			cols |= line;
+	}
+
+	for(int i=0; i<15; i++)
+	{
+		if((occupied & masks.diagonals[i]) == masks.diagonals[i])
+			diagonals |= masks.diagonals[i];
+		if((occupied & masks.antidiagonals[i]) == masks.antidiagonals[i])
+			antidiagonals |= masks.antidiagonals[i];
+	}
+}
+
+
+// returns the discs of (mine) that can never be flipped again
+// a disc is stable when, along each of the four lines through it, the line is full or it
+// sits against the edge or a stable disc of its own color; corners qualify straight away,
+// and the stable set is flood-filled outward from them until it stops growing
+// Parameters: (mine) - the discs being checked
+// (theirs) - the opposing discs
+Bitboard stableDiscs(Bitboard mine, Bitboard theirs)
+{
+	Bitboard rows; Bitboard cols; Bitboard diagonals; Bitboard antidiagonals;
+	Bitboard stable = 0; Bitboard previous;
+
+	filledLines(mine | theirs,rows,cols,diagonals,antidiagonals);
+
+	// the edges protect every direction that would leave the board
+	rows |= FILE_A | FILE_H;
+	cols |= RANK_1 | RANK_8;
+	diagonals |= BORDER;
+	antidiagonals |= BORDER;
+
+	do
+	{
+		previous = stable;
+		stable |= mine
+			& (rows | shiftE(stable) | shiftW(stable))
+			& (cols | shiftN(stable) | shiftS(stable))
+			& (diagonals | shiftSE(stable) | shiftNW(stable))
+			& (antidiagonals | shiftSW(stable) | shiftNE(stable));
+	}
+	while(stable != previous);
+
+	return stable;
+}
+
+
+// returns the discs of (mine) that touch an empty square
+// Parameters: (mine) - the discs being checked
+// (theirs) - the opposing discs
+Bitboard frontierDiscs(Bitboard mine, Bitboard theirs)
+{
+	return mine & neighbors(~(mine | theirs));
+}
+
+
+// returns the empty squares next to an opposing disc, where moves may open up later
+// Parameters: (mine) - the discs of the side that would move
+// (theirs) - the opposing discs
+Bitboard potentialMobility(Bitboard mine, Bitboard theirs)
+{
+	return ~(mine | theirs) & neighbors(theirs);
+}
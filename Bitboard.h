@@ -0,0 +1,27 @@
+// Bitboard.h - Othello bitboard declaration
+// Written by Paul Jang
+
+#pragma once
+
+#include "Othello.h"
+
+// one bit per square, bit (row * 8 + col)
+typedef unsigned long long Bitboard;
+
+// splits the board into the discs of one color and the discs of the other
+void toBitboards(char gameBoard[ROWS][COLS], char color, Bitboard& mine, Bitboard& theirs);
+
+// counts the set bits of a bitboard
+int popCount(Bitboard bits);
+
+// returns every square next to one of the given squares, in any of the eight directions
+Bitboard neighbors(Bitboard bits);
+
+// returns the discs of (mine) that can never be flipped again
+Bitboard stableDiscs(Bitboard mine, Bitboard theirs);
+
+// returns the discs of (mine) that touch an empty square
+Bitboard frontierDiscs(Bitboard mine, Bitboard theirs);
+
+// returns the empty squares next to an opposing disc, where moves may open up later
+Bitboard potentialMobility(Bitboard mine, Bitboard theirs);
@@ -1,4 +1,47 @@
 // Othello.h - Othello function declaration
 // Written by Paul Jang
 
+#pragma once
 
+#include <vector>
+#include <string>
+#include "Player.h"
+#include "Random.h"
+
+#define ROWS	8	 // standard size for rows
+#define COLS	8	 // standard size for columns
+
+// initiates the game with an empty board and four pieces in the center
+void initiate(char empty[ROWS][COLS]);
+
+// displays the current game board
+void displayBoard(const char gameBoard[ROWS][COLS]);
+
+// outputs a list of viable moves to be made
+void listMoves(char gameBoard[ROWS][COLS], std::vector<int>& legalRows, std::vector<int>& legalCols, char disc);
+
+// lists the viable moves for the AI without outputting them
+void listMovesAI(char gameBoard[ROWS][COLS], std::vector<int>& legalRows, std::vector<int>& legalCols, char disc);
+
+// takes a coordinate and changes the board accordingly
+void flipDiscs(char gameBoard[ROWS][COLS], int& row, int& col, char color);
+
+// counts the current amount of pieces for either color
+int countPieces(char gameBoard[ROWS][COLS], char color);
+
+// counts the total pieces currently on the board
+int totalPieces(char gameBoard[ROWS][COLS]);
+
+// gets a move from the AI
+void getAIMove(Player mover, char gameBoard[ROWS][COLS], std::vector<int>& rows, std::vector<int>& cols,
+			   int& row, int& col, char color, int& tracker, Random& rng);
+
+// checks the move for validity
+bool checkMove(std::vector<int>& rows, std::vector<int>& cols, int& row, int& col);
+
+// inputs a human move
+void getHumanMove(char gameBoard[ROWS][COLS], std::vector<int>& rows, std::vector<int>& cols,
+				  int& row, int& col, char color, int& tracker);
+
+// adds a move to the game record
+void recordMove(std::string& record, int row, int col);
@@ -0,0 +1,82 @@
+// Random.h - Othello random number generator class declaration
+// Written by Paul Jang
+
+#pragma once
+
+// xoshiro256** generator, one per game or per thread, never shared
+// the same master seed and stream always give the same numbers, on every platform
+class Random
+{
+public:
+	// default constructor, takes the master seed and the stream (the game index) as arguments
+	Random(unsigned long long seed, unsigned long long stream = 0)
+	{
+		setSeed(seed,stream);
+	}
+
+	// restarts the generator, takes the master seed and the stream as arguments
+	void setSeed(unsigned long long seed, unsigned long long stream)
+	{
+		// every stream of a master seed starts from a different splitmix64 state
+		unsigned long long state = splitMix(seed) ^ stream;
+
+		for(int i=0; i<4; i++)
+		{
+			State[i] = splitMix(state);
+		}
+	}
+
+	// returns the next 64 random bits
+	unsigned long long next()
+	{
+		unsigned long long result = rotate(State[1] * 5,7) * 9;
+		unsigned long long shifted = State[1] << 17;
+
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+		State[2] ^= shifted;
+		State[3] = rotate(State[3],45);
+
+		return result;
+	}
+
+	// returns a random number from 0 up to but not including (bound), without modulo bias
+	unsigned int nextInt(unsigned int bound)
+	{
+		// keeps the high half of a 32 by 32 bit product, rejecting the few values that would favor low numbers
+		unsigned long long product = (next() >> 32) * bound;
+		unsigned int low = (unsigned int)product;
+
+		if(low < bound)
+		{
+			unsigned int threshold = (0u - bound) % bound;
+			while(low < threshold)
+			{
+				product = (next() >> 32) * bound;
+				low = (unsigned int)product;
+			}
+		}
+		return (unsigned int)(product >> 32);
+	}
+
+	// splitmix64 step, also used to derive independent keys from a single seed
+	static unsigned long long splitMix(unsigned long long& state)
+	{
+		unsigned long long z = (state += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		return z ^ (z >> 31);
+	}
+
+private:
+	// rotates the bits of (x) left by (k)
+	static unsigned long long rotate(unsigned long long x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	// the generator state
+	unsigned long long State[4];
+};
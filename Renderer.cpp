@@ -0,0 +1,187 @@
+// Renderer.cpp - Othello board renderer class definition
+// Written by Paul Jang
+
+// including various necessary files
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "Renderer.h"
+
+using namespace std;
+
+
+#define BOARD_LINES	(ROWS + 2)		// blank line, column numbers, one line per row
+#define SCROLL_TOP	(BOARD_LINES + 2)	// first terminal line left free for text in place mode
+
+
+// default constructor, draws full frames without throttling
+BoardRenderer::BoardRenderer()
+{
+	Showing = false;
+	CurrentMode = FULL_FRAMES;
+	ThrottleMs = 0;
+}
+
+
+// builds the board in the same layout displayBoard has always printed
+// Parameters: (gameBoard) - char array representing the game board
+// (length) - where in the buffer to start
+int BoardRenderer::fullFrame(const char gameBoard[ROWS][COLS], int length)
+{
+	// spaces for neat formatting, then the column numbers
+	Frame[length++] = '\n';
+	Frame[length++] = ' ';
+	Frame[length++] = ' ';
+	for(int c=0; c<COLS; c++)
+	{
+		Frame[length++] = (char)('0' + c);
+		Frame[length++] = ' ';
+	}
+	Frame[length++] = '\n';
+
+	// the row number followed by each square
+	for(int r=0; r<ROWS; r++)
+	{
+		Frame[length++] = (char)('0' + r);
+		Frame[length++] = ' ';
+		for(int c=0; c<COLS; c++)
+		{
+			Frame[length++] = gameBoard[r][c];
+			Frame[length++] = ' ';
+		}
+		Frame[length++] = '\n';
+	}
+
+	memcpy(Shown,gameBoard,sizeof(Shown));
+	return length;
+}
+
+
+// builds cursor moves to every square that differs from the shown board
+// Parameters: (gameBoard) - char array representing the game board
+// (length) - where in the buffer to start
+int BoardRenderer::changesFrame(const char gameBoard[ROWS][COLS], int length)
+{
+	for(int r=0; r<ROWS; r++)
+	{
+		for(int c=0; c<COLS; c++)
+		{
+			if(gameBoard[r][c] == Shown[r][c])
+				continue;
+
+			// squares sit on terminal line r + 3 and column 2c + 3, both counted from 1
+			length += snprintf(Frame + length,FRAME_SIZE - length,"\x1b[%d;%dH%c",r + 3,2 * c + 3,gameBoard[r][c]);
+			Shown[r][c] = gameBoard[r][c];
+		}
+	}
+	return length;
+}
+
+
+// copies a constant escape sequence into the buffer
+// Parameters: (text) - the characters to add
+// (length) - where in the buffer to add them
+int BoardRenderer::append(const char* text, int length)
+{
+	int size = (int)strlen(text);
+
+	memcpy(Frame + length,text,size);
+	return length + size;
+}
+
+
+// writes the buffer to the terminal in one call
+// Parameter : (length) - the number of characters in the buffer
+void BoardRenderer::writeFrame(int length)
+{
+	// anything already printed through cout has to come out first
+	cout.flush();
+	fflush(stdout);
+
+#ifdef _WIN32
+	_write(1,Frame,length);
+#else
+	if(write(STDOUT_FILENO,Frame,length) < 0)
+		return;
+#endif
+
+	LastFrame = chrono::steady_clock::now();
+}
+
+
+// draws the board, unless the mode or the throttle says otherwise
+// Parameter : (gameBoard) - char array representing the game board
+void BoardRenderer::draw(const char gameBoard[ROWS][COLS])
+{
+	int length = 0;
+
+	if(CurrentMode == SKIP)
+		return;
+
+	// drops the frame if the last one went out too recently
+	if(ThrottleMs > 0 && Showing
+		&& chrono::steady_clock::now() - LastFrame < chrono::milliseconds(ThrottleMs))
+		return;
+
+	if(CurrentMode == FULL_FRAMES)
+		length = fullFrame(gameBoard,length);
+
+	// the first board clears the screen and keeps the text scrolling below it
+	else if(!Showing)
+	{
+		length = append("\x1b[2J\x1b[H",length);
+		length = fullFrame(gameBoard,length);
+		length += snprintf(Frame + length,FRAME_SIZE - length,"\x1b[%dr\x1b[%d;1H",SCROLL_TOP,SCROLL_TOP);
+	}
+
+	// later boards only redraw their changes, leaving the text cursor where it was
+	else
+	{
+		length = append("\x1b" "7",length);
+		int saved = length;
+		length = changesFrame(gameBoard,length);
+		if(length == saved)
+			return;
+		length = append("\x1b" "8",length);
+	}
+
+	Showing = true;
+	writeFrame(length);
+}
+
+
+// always draws the final board of a game and gives the terminal back
+// Parameter : (gameBoard) - char array representing the game board
+void BoardRenderer::finish(const char gameBoard[ROWS][COLS])
+{
+	int length = 0;
+
+	// the pinned board gets its last changes and the whole terminal scrolls again
+	if(CurrentMode == IN_PLACE && Showing)
+	{
+		length = append("\x1b" "7",length);
+		length = changesFrame(gameBoard,length);
+		length = append("\x1b[r\x1b" "8",length);
+	}
+
+	// otherwise shows the final board if the last one drawn wasn't it
+	else if(!Showing || memcmp(Shown,gameBoard,sizeof(Shown)) != 0)
+		length = fullFrame(gameBoard,length);
+
+	if(length > 0)
+		writeFrame(length);
+	Showing = false;
+}
+
+
+// returns the renderer every board is drawn through
+BoardRenderer& getRenderer()
+{
+	static BoardRenderer renderer;
+	return renderer;
+}
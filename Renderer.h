@@ -0,0 +1,74 @@
+// Renderer.h - Othello board renderer class declaration
+// Written by Paul Jang
+
+#pragma once
+
+#include <chrono>
+#include "Othello.h"
+
+#define FRAME_SIZE	1024	// large enough for a full board or a change to every square
+
+class BoardRenderer
+{
+public:
+	// the ways a board can be drawn
+	enum Mode
+	{
+		FULL_FRAMES,	// every board is printed below the last one
+		IN_PLACE,		// one board is pinned to the top of the terminal and only changed squares are redrawn
+		SKIP			// boards are not drawn until the game is finished
+	};
+
+	// default constructor, draws full frames without throttling
+	BoardRenderer();
+
+	// sets how boards are drawn, takes the mode as an argument
+	// changing the mode starts over, so a pinned board is always set up on its first frame
+	void setMode(Mode mode)
+	{
+		if(mode != CurrentMode)
+			Showing = false;
+		CurrentMode = mode;
+	}
+
+	// sets the least time between two frames, takes the milliseconds as an argument
+	// boards that come in sooner are dropped, 0 draws every board
+	void setThrottle(int ms)
+	{
+		ThrottleMs = ms;
+	}
+
+	// draws the board, unless the mode or the throttle says otherwise
+	void draw(const char gameBoard[ROWS][COLS]);
+
+	// always draws the final board of a game and gives the terminal back
+	void finish(const char gameBoard[ROWS][COLS]);
+
+private:
+	// builds the frame for the board into the buffer and returns its length
+	int fullFrame(const char gameBoard[ROWS][COLS], int length);
+	int changesFrame(const char gameBoard[ROWS][COLS], int length);
+
+	// adds a constant escape sequence to the buffer and returns the new length
+	int append(const char* text, int length);
+
+	// writes the buffer to the terminal in one call
+	void writeFrame(int length);
+
+	// the frame being built, allocated once
+	char Frame[FRAME_SIZE];
+
+	// the board as it is currently shown, and whether one is showing
+	char Shown[ROWS][COLS];
+	bool Showing;
+
+	// the current mode and throttle
+	Mode CurrentMode;
+	int ThrottleMs;
+
+	// when the last frame was written
+	std::chrono::steady_clock::time_point LastFrame;
+};
+
+// returns the renderer every board is drawn through
+BoardRenderer& getRenderer();
@@ -0,0 +1,593 @@
+// Search.cpp - Othello search and analysis definitions
+// Written by Paul Jang
+
+// including various necessary files
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <string.h>
+#include "Search.h"
+#include "Bitboard.h"
+#include "Random.h"
+
+using namespace std;
+
+
+#define EXACT_BOUND	0	// the stored score is exact
+#define LOWER_BOUND	1	// the stored score failed high
+#define UPPER_BOUND	2	// the stored score failed low
+
+// positional value of each square, corners are good and the squares next to them are bad
+static const int squareWeights[ROWS][COLS] =
+{
+	{ 100, -20,  10,   5,   5,  10, -20, 100 },
+	{ -20, -50,  -2,  -2,  -2,  -2, -50, -20 },
+	{  10,  -2,  -1,  -1,  -1,  -1,  -2,  10 },
+	{   5,  -2,  -1,  -1,  -1,  -1,  -2,   5 },
+	{   5,  -2,  -1,  -1,  -1,  -1,  -2,   5 },
+	{  10,  -2,  -1,  -1,  -1,  -1,  -2,  10 },
+	{ -20, -50,  -2,  -2,  -2,  -2, -50, -20 },
+	{ 100, -20,  10,   5,   5,  10, -20, 100 },
+};
+
+// random keys for hashing boards, one per square and color plus one for white to move
+struct ZobristKeys
+{
+	unsigned long long squares[ROWS * COLS][2];
+	unsigned long long white;
+
+	// fills the keys from a fixed seed so hashes are the same on every run
+	ZobristKeys()
+	{
+		unsigned long long state = 0x4f7468656c6c6fULL;
+		for(int i=0; i<ROWS * COLS; i++)
+		{
+			squares[i][0] = Random::splitMix(state);
+			squares[i][1] = Random::splitMix(state);
+		}
+		white = Random::splitMix(state);
+	}
+};
+
+// returns the hashing keys, built once on first use
+static const ZobristKeys& zobrist()
+{
+	static const ZobristKeys keys;
+	return keys;
+}
+
+
+// hashes the board together with the side to move
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side to move
+static unsigned long long hashBoard(char gameBoard[ROWS][COLS], char color)
+{
+	const ZobristKeys& keys = zobrist();
+	unsigned long long key = (color == 'w') ? keys.white : 0;
+
+	for(int r=0; r<ROWS; r++)
+	{
+		for(int c=0; c<COLS; c++)
+		{
+			if(gameBoard[r][c] == 'w')
+				key ^= keys.squares[r * COLS + c][0];
+			else if(gameBoard[r][c] == 'b')
+				key ^= keys.squares[r * COLS + c][1];
+		}
+	}
+	return key;
+}
+
+
+// scores a game result from the final disc difference
+// Parameter : (difference) - own discs minus opposing discs
+static int outcomeScore(int difference)
+{
+	if(difference > 0)
+		return WIN_SCORE + difference;
+	if(difference < 0)
+		return -WIN_SCORE + difference;
+	return 0;
+}
+
+
+// scores a finished game from the disc difference
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side the score is for
+static int finalScore(char gameBoard[ROWS][COLS], char color)
+{
+	char opponent = (color == 'w') ? 'b' : 'w';
+	return outcomeScore(countPieces(gameBoard,color) - countPieces(gameBoard,opponent));
+}
+
+
+// orders the moves best first, the transposition table move and then by square weight
+// Parameters: (moves) - the moves to order
+// (best) - the square index of the table move, or -1 if there is none
+static void orderMoves(vector<Move>& moves, int best)
+{
+	vector<int> keys(moves.size());
+
+	for(unsigned int i=0; i<moves.size(); i++)
+	{
+		if(moves[i].row * COLS + moves[i].col == best)
+			keys[i] = INF_SCORE;
+		else
+			keys[i] = squareWeights[moves[i].row][moves[i].col];
+	}
+
+	// insertion sort, the lists are short
+	for(unsigned int i=1; i<moves.size(); i++)
+	{
+		Move move = moves[i]; int key = keys[i]; int j = i - 1;
+		while(j >= 0 && keys[j] < key)
+		{
+			moves[j+1] = moves[j];
+			keys[j+1] = keys[j];
+			j--;
+		}
+		moves[j+1] = move;
+		keys[j+1] = key;
+	}
+}
+
+
+// lists each legal move once, in board order
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side to move
+// (moves) - vector the legal moves are added to
+void generateMoves(char gameBoard[ROWS][COLS], char color, vector<Move>& moves)
+{
+	vector<int> rows; vector<int> cols;
+	bool seen[ROWS][COLS];
+
+	listMovesAI(gameBoard,rows,cols,color);
+	memset(seen,0,sizeof(seen));
+
+	// listMovesAI reports a square once for every direction it flips in
+	for(unsigned int i=0; i<rows.size(); i++)
+	{
+		if(seen[rows[i]][cols[i]])
+			continue;
+		seen[rows[i]][cols[i]] = true;
+
+		Move move = { rows[i], cols[i] };
+		moves.push_back(move);
+	}
+}
+
+
+// statically evaluates the board from square weights, mobility, stability and frontier
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side the score is for
+int evaluate(char gameBoard[ROWS][COLS], char color)
+{
+	char opponent = (color == 'w') ? 'b' : 'w';
+	vector<Move> mine; vector<Move> theirs;
+	Bitboard myDiscs; Bitboard theirDiscs;
+	int score = 0;
+
+	// adds up the weights of the occupied squares
+	for(int r=0; r<ROWS; r++)
+	{
+		for(int c=0; c<COLS; c++)
+		{
+			if(gameBoard[r][c] == color)
+				score += squareWeights[r][c];
+			else if(gameBoard[r][c] == opponent)
+				score -= squareWeights[r][c];
+		}
+	}
+
+	// having more moves than the opponent is worth a lot in the middle game
+	generateMoves(gameBoard,color,mine);
+	generateMoves(gameBoard,opponent,theirs);
+	score += 10 * ((int)mine.size() - (int)theirs.size());
+
+	// discs that can't be flipped are worth having, discs next to empty squares are not
+	toBitboards(gameBoard,color,myDiscs,theirDiscs);
+	score += 30 * (popCount(stableDiscs(myDiscs,theirDiscs)) - popCount(stableDiscs(theirDiscs,myDiscs)));
+	score -= 8 * (popCount(frontierDiscs(myDiscs,theirDiscs)) - popCount(frontierDiscs(theirDiscs,myDiscs)));
+	score += 4 * (popCount(potentialMobility(myDiscs,theirDiscs)) - popCount(potentialMobility(theirDiscs,myDiscs)));
+
+	return score;
+}
+
+
+// formats a move the way game records write it, "rc" or 'p' for a pass
+// Parameter : (move) - the move to format
+string moveText(const Move& move)
+{
+	string text;
+	recordMove(text,move.row,move.col);
+	return text;
+}
+
+
+// formats a score, spelling out the result of finished games
+// Parameter : (score) - the score to format
+string scoreText(int score)
+{
+	ostringstream text;
+
+	if(score > WIN_SCORE / 2)
+		text << "win by " << score - WIN_SCORE;
+	else if(score < -WIN_SCORE / 2)
+		text << "loss by " << -WIN_SCORE - score;
+	else
+		text << showpos << score;
+
+	return text.str();
+}
+
+
+// default constructor, takes the log2 size of the transposition table as an argument
+Search::Search(int tableBits)
+{
+	Table.resize((size_t)1 << tableBits);
+	Mask = Table.size() - 1;
+	Nodes = 0;
+	Depth = 0;
+	Stopped = false;
+	clear();
+}
+
+
+// empties the transposition table
+void Search::clear()
+{
+	for(unsigned int i=0; i<Table.size(); i++)
+	{
+		Table[i].key = 0;
+		Table[i].depth = -1;
+		Table[i].best = -1;
+	}
+}
+
+
+// alpha-beta search below the root, using a null window for every move after the first
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side to move
+// (depth) - the remaining depth, passes don't use any
+// (alpha + beta) - the search window
+// (ply) - the distance from the root
+int Search::negamax(char gameBoard[ROWS][COLS], char color, int depth, int alpha, int beta, int ply)
+{
+	char opponent = (color == 'w') ? 'b' : 'w';
+	char child[ROWS][COLS];
+	vector<Move> moves;
+	bool pvNode = (beta - alpha > 1);
+	int alphaStart = alpha;
+	int best = -INF_SCORE; int bestSquare = -1;
+	int score;
+
+	PVLength[ply] = ply;
+
+	// the first iteration always completes, later ones stop when the time runs out
+	if((++Nodes & 1023) == 0 && Depth > 1 && chrono::steady_clock::now() >= Deadline)
+		Stopped = true;
+	if(Stopped)
+		return 0;
+
+	generateMoves(gameBoard,color,moves);
+
+	// with no moves the game is either over or the side to move passes
+	if(moves.size() == 0)
+	{
+		vector<Move> replies;
+		generateMoves(gameBoard,opponent,replies);
+		if(replies.size() == 0)
+			return finalScore(gameBoard,color);
+
+		score = -negamax(gameBoard,opponent,depth,-beta,-alpha,ply+1);
+
+		PV[ply][ply].row = PV[ply][ply].col = -1;
+		for(int i=ply+1; i<PVLength[ply+1]; i++)
+			PV[ply][i] = PV[ply+1][i];
+		PVLength[ply] = PVLength[ply+1];
+		return score;
+	}
+
+	if(depth <= 0 || ply >= MAX_PLY - 1)
+		return evaluate(gameBoard,color);
+
+	// when the search reaches the end of the game, stable discs bound the final score
+	// and the window can be given up early if it lies outside those bounds
+	Bitboard myDiscs; Bitboard theirDiscs;
+	toBitboards(gameBoard,color,myDiscs,theirDiscs);
+	if(depth >= popCount(~(myDiscs | theirDiscs)))
+	{
+		int upper = outcomeScore(ROWS * COLS - 2 * popCount(stableDiscs(theirDiscs,myDiscs)));
+		if(upper <= alpha)
+			return upper;
+
+		int lower = outcomeScore(2 * popCount(stableDiscs(myDiscs,theirDiscs)) - ROWS * COLS);
+		if(lower >= beta)
+			return lower;
+	}
+
+	// uses the table entry for a cutoff outside the principal variation, and for ordering
+	unsigned long long key = hashBoard(gameBoard,color);
+	Entry& entry = Table[key & Mask];
+	int tableBest = -1;
+	if(entry.key == key)
+	{
+		tableBest = entry.best;
+		if(!pvNode && entry.depth >= depth)
+		{
+			if(entry.flag == EXACT_BOUND
+				|| (entry.flag == LOWER_BOUND && entry.score >= beta)
+				|| (entry.flag == UPPER_BOUND && entry.score <= alpha))
+			{
+				return entry.score;
+			}
+		}
+	}
+	orderMoves(moves,tableBest);
+
+	for(unsigned int i=0; i<moves.size(); i++)
+	{
+		memcpy(child,gameBoard,sizeof(child));
+		flipDiscs(child,moves[i].row,moves[i].col,color);
+
+		if(i == 0)
+			score = -negamax(child,opponent,depth-1,-beta,-alpha,ply+1);
+		else
+		{
+			score = -negamax(child,opponent,depth-1,-alpha-1,-alpha,ply+1);
+			if(score > alpha && score < beta)
+				score = -negamax(child,opponent,depth-1,-beta,-alpha,ply+1);
+		}
+
+		if(Stopped)
+			return 0;
+
+		if(score > best)
+		{
+			best = score;
+			bestSquare = moves[i].row * COLS + moves[i].col;
+
+			// the line through this move becomes the principal variation
+			if(score > alpha)
+			{
+				alpha = score;
+				PV[ply][ply] = moves[i];
+				for(int j=ply+1; j<PVLength[ply+1]; j++)
+					PV[ply][j] = PV[ply+1][j];
+				PVLength[ply] = PVLength[ply+1];
+			}
+			if(alpha >= beta)
+				break;
+		}
+	}
+
+	entry.key = key;
+	entry.score = best;
+	entry.depth = (short)depth;
+	entry.best = (char)bestSquare;
+	if(best <= alphaStart)
+		entry.flag = UPPER_BOUND;
+	else if(best >= beta)
+		entry.flag = LOWER_BOUND;
+	else
+		entry.flag = EXACT_BOUND;
+
+	return best;
+}
+
+
+// searches the board for the best (multiPV) moves by iterative deepening
+// each line is a full root search over the moves not yet ranked, all sharing the table
+// Parameters: (gameBoard) - char array representing the game board
+// (color) - char representing the side to move
+// (multiPV) - the number of lines wanted, 0 for every legal move
+// (timeMs) - milliseconds the analysis may take, the first iteration always completes
+vector<PVLine> Search::analyze(char gameBoard[ROWS][COLS], char color, int multiPV, int timeMs)
+{
+	char opponent = (color == 'w') ? 'b' : 'w';
+	char child[ROWS][COLS];
+	vector<Move> rootMoves; vector<PVLine> result;
+	int empties = ROWS * COLS - totalPieces(gameBoard);
+
+	Deadline = chrono::steady_clock::now() + chrono::milliseconds(timeMs);
+	Stopped = false;
+	Nodes = 0;
+
+	generateMoves(gameBoard,color,rootMoves);
+	orderMoves(rootMoves,-1);
+	if(multiPV <= 0 || multiPV > (int)rootMoves.size())
+		multiPV = (int)rootMoves.size();
+
+	// searching deeper than the empty squares can't change the scores
+	for(Depth=1; Depth<=empties && Depth<MAX_PLY; Depth++)
+	{
+		vector<PVLine> lines;
+		vector<Move> remaining = rootMoves;
+
+		while((int)lines.size() < multiPV && remaining.size() != 0)
+		{
+			PVLine line;
+			int alpha = -INF_SCORE; int bestIndex = -1; int score;
+
+			for(unsigned int i=0; i<remaining.size(); i++)
+			{
+				memcpy(child,gameBoard,sizeof(child));
+				flipDiscs(child,remaining[i].row,remaining[i].col,color);
+
+				if(bestIndex < 0)
+					score = -negamax(child,opponent,Depth-1,-INF_SCORE,INF_SCORE,1);
+				else
+				{
+					score = -negamax(child,opponent,Depth-1,-alpha-1,-alpha,1);
+					if(score > alpha)
+						score = -negamax(child,opponent,Depth-1,-INF_SCORE,-alpha,1);
+				}
+
+				if(Stopped)
+					break;
+
+				if(bestIndex < 0 || score > alpha)
+				{
+					alpha = score;
+					bestIndex = i;
+					line.move = remaining[i];
+					line.score = score;
+					line.pv.assign(1,remaining[i]);
+					line.pv.insert(line.pv.end(),PV[1] + 1,PV[1] + PVLength[1]);
+				}
+			}
+
+			if(Stopped)
+				break;
+
+			line.depth = Depth;
+			lines.push_back(line);
+			remaining.erase(remaining.begin() + bestIndex);
+		}
+
+		// an unfinished iteration is thrown away
+		if(Stopped)
+			break;
+		result = lines;
+
+		// the next iteration tries the ranked moves first
+		rootMoves.clear();
+		for(unsigned int i=0; i<lines.size(); i++)
+			rootMoves.push_back(lines[i].move);
+		rootMoves.insert(rootMoves.end(),remaining.begin(),remaining.end());
+
+		if(chrono::steady_clock::now() >= Deadline)
+			break;
+	}
+
+	return result;
+}
+
+
+// annotates every move of a game record, searching each position for a fixed time
+// the positions are searched in parallel, one thread per core
+// Parameters: (record) - the moves of the game as written by recordMove, white moves first
+// (timeMs) - milliseconds to spend on each position
+// (multiPV) - the number of ranked lines shown for each position
+bool analyzeGame(const string& record, int timeMs, int multiPV)
+{
+	vector<vector<char> > boards; vector<char> colors; vector<Move> played;
+	char board[ROWS][COLS]; char color = 'w';
+	istringstream tokens(record);
+	string token;
+
+	// replays the record, keeping the position before every move
+	initiate(board);
+	while(tokens >> token)
+	{
+		Move move = { -1, -1 };
+		vector<Move> legal;
+
+		if(token != "p" && token != "P")
+		{
+			if(token.size() != 2 || token[0] < '0' || token[0] >= '0' + ROWS
+				|| token[1] < '0' || token[1] >= '0' + COLS)
+			{
+				cout << "Move " << played.size() + 1 << " '" << token << "' is not a valid move..." << endl;
+				return false;
+			}
+			move.row = token[0] - '0';
+			move.col = token[1] - '0';
+
+			generateMoves(board,color,legal);
+			bool found = false;
+			for(unsigned int i=0; i<legal.size(); i++)
+			{
+				if(legal[i].row == move.row && legal[i].col == move.col)
+					found = true;
+			}
+			if(!found)
+			{
+				cout << "Move " << played.size() + 1 << " '" << token << "' is not a legal move..." << endl;
+				return false;
+			}
+		}
+
+		boards.push_back(vector<char>(&board[0][0],&board[0][0] + ROWS * COLS));
+		colors.push_back(color);
+		played.push_back(move);
+
+		if(move.row >= 0)
+			flipDiscs(board,move.row,move.col,color);
+		color = (color == 'w') ? 'b' : 'w';
+	}
+
+	// every position is searched for all of its moves, so the played move always has a score
+	int count = (int)played.size();
+	vector<vector<PVLine> > results(count);
+	atomic<int> next(0);
+	unsigned int threads = thread::hardware_concurrency();
+	if(threads == 0)
+		threads = 1;
+	if(threads > (unsigned int)count)
+		threads = (unsigned int)count;
+
+	vector<thread> workers;
+	for(unsigned int t=0; t<threads; t++)
+	{
+		workers.push_back(thread([&]()
+		{
+			Search search(18);
+			char position[ROWS][COLS];
+			int i;
+
+			while((i = next++) < count)
+			{
+				memcpy(position,&boards[i][0],sizeof(position));
+				results[i] = search.analyze(position,colors[i],0,timeMs);
+			}
+		}));
+	}
+	for(unsigned int t=0; t<workers.size(); t++)
+		workers[t].join();
+
+	// outputs the annotations in game order
+	for(int i=0; i<count; i++)
+	{
+		const vector<PVLine>& lines = results[i];
+		cout << endl << setw(2) << i + 1 << ". " << (colors[i] == 'w' ? "White " : "Black ") << moveText(played[i]);
+
+		if(lines.size() == 0)
+		{
+			cout << "   (no legal moves)" << endl;
+			continue;
+		}
+
+		// finds the score of the move that was played
+		int rank = -1;
+		for(unsigned int j=0; j<lines.size(); j++)
+		{
+			if(lines[j].move.row == played[i].row && lines[j].move.col == played[i].col)
+				rank = j;
+		}
+
+		if(rank < 0)
+			cout << "   passed with legal moves available";
+		else
+			cout << "   score " << scoreText(lines[rank].score) << "   rank " << rank + 1 << " of " << lines.size();
+		if(rank != 0)
+			cout << "   best " << moveText(lines[0].move) << " " << scoreText(lines[0].score);
+		cout << "   depth " << lines[0].depth << endl;
+
+		for(int j=0; j<multiPV && j<(int)lines.size(); j++)
+		{
+			cout << "      " << j + 1 << ") " << moveText(lines[j].move) << "  " << setw(10) << left
+				 << scoreText(lines[j].score) << right << " pv";
+			for(unsigned int k=0; k<lines[j].pv.size(); k++)
+				cout << " " << moveText(lines[j].pv[k]);
+			cout << endl;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,103 @@
+// Search.h - Othello search and analysis declaration
+// Written by Paul Jang
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include "Othello.h"
+
+#define MAX_PLY		128		// deepest line the search can follow, passes included
+#define INF_SCORE	32000	// bound above any score the search can return
+#define WIN_SCORE	10000	// finished games score this plus the disc difference
+
+// a single move, with a row of -1 for a pass
+struct Move
+{
+	int row;
+	int col;
+};
+
+// one ranked line of a multi-PV search
+struct PVLine
+{
+	// the first move of the line
+	Move move;
+
+	// the score of the line for the side to move
+	int score;
+
+	// the depth the score was searched to
+	int depth;
+
+	// the principal variation, starting with the move itself
+	std::vector<Move> pv;
+};
+
+// statically evaluates the board for the given color
+int evaluate(char gameBoard[ROWS][COLS], char color);
+
+// lists each legal move once, in board order
+void generateMoves(char gameBoard[ROWS][COLS], char color, std::vector<Move>& moves);
+
+// formats a move the way game records write it
+std::string moveText(const Move& move);
+
+// formats a score, spelling out the result of finished games
+std::string scoreText(int score);
+
+// annotates every move of a game record, searching each position for a fixed time
+bool analyzeGame(const std::string& record, int timeMs, int multiPV);
+
+class Search
+{
+public:
+	// default constructor, takes the log2 size of the transposition table as an argument
+	Search(int tableBits = 20);
+
+	// empties the transposition table
+	void clear();
+
+	// searches the board for the best (multiPV) moves, or every move if multiPV is 0
+	// returns the lines best first, searched as deep as (timeMs) allows
+	std::vector<PVLine> analyze(char gameBoard[ROWS][COLS], char color, int multiPV, int timeMs);
+
+	// returns the number of nodes visited by the last analysis
+	long getNodes() const
+	{
+		return Nodes;
+	}
+
+private:
+	// one transposition table slot
+	struct Entry
+	{
+		unsigned long long key;
+		int score;
+		short depth;
+		char flag;
+		char best;
+	};
+
+	// alpha-beta search below the root, fills the principal variation at (ply)
+	int negamax(char gameBoard[ROWS][COLS], char color, int depth, int alpha, int beta, int ply);
+
+	// the transposition table, shared by every line of an analysis
+	std::vector<Entry> Table;
+
+	// mask selecting a table slot from a hash key
+	unsigned long long Mask;
+
+	// triangular principal variation table and the length of each row
+	Move PV[MAX_PLY][MAX_PLY];
+	int PVLength[MAX_PLY];
+
+	// nodes visited, and the iteration currently being searched
+	long Nodes;
+	int Depth;
+
+	// when the analysis must stop, and whether it has
+	std::chrono::steady_clock::time_point Deadline;
+	bool Stopped;
+};
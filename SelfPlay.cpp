@@ -0,0 +1,138 @@
+// SelfPlay.cpp - Othello self-play definitions
+// Written by Paul Jang
+
+// including various necessary files
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include "SelfPlay.h"
+
+using namespace std;
+
+
+#define BATCH_CHUNK	256		// games a thread takes from the batch at a time
+
+
+// plays one game of random AI moves, white first, the same way two computer players do
+// Parameters: (rng) - the random number generator of the game
+// (gameBoard) - char array the game is played on, holding the final position afterwards
+// (record) - string the game record is written to, or NULL
+unsigned long long playRandomGame(Random& rng, char gameBoard[ROWS][COLS], string* record)
+{
+	vector<int> rows; vector<int> cols;
+	unsigned long long hash = 0xcbf29ce484222325ULL;
+	char color = 'w'; int passes = 0;
+	int row; int col; int index;
+
+	initiate(gameBoard);
+	if(record != NULL)
+		record->clear();
+
+	// the game ends when the board is full or both players have to pass
+	while(totalPieces(gameBoard) < ROWS * COLS && passes < 2)
+	{
+		rows.clear(); cols.clear();
+		listMovesAI(gameBoard,rows,cols,color);
+
+		// picks a move exactly as getAIMove does, so the same seed plays the same game
+		if(rows.size() != 0)
+		{
+			index = rng.nextInt(rows.size());
+			row = rows[index];
+			col = cols[index];
+			flipDiscs(gameBoard,row,col,color);
+			passes = 0;
+		}
+		else
+		{
+			row = col = -1;
+			passes++;
+		}
+
+		// FNV-1a over the moved squares, a pass counts as square 64
+		hash = (hash ^ (unsigned long long)(row < 0 ? ROWS * COLS : row * COLS + col)) * 0x100000001b3ULL;
+		if(record != NULL)
+			recordMove(*record,row,col);
+
+		color = (color == 'w') ? 'b' : 'w';
+	}
+
+	return hash;
+}
+
+
+// plays (games) random games in parallel, one thread per core, and outputs the totals
+// every game has its own generator, so the totals and checksum don't depend on the thread count
+// Parameters: (seed) - the master seed of the batch
+// (games) - the number of games to play
+void runSelfPlay(unsigned long long seed, long games)
+{
+	atomic<long> next(0);
+	atomic<long> whiteWins(0); atomic<long> blackWins(0); atomic<long> draws(0);
+	atomic<unsigned long long> checksum(0);
+	unsigned int threads = thread::hardware_concurrency();
+	if(threads == 0)
+		threads = 1;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	vector<thread> workers;
+	for(unsigned int t=0; t<threads; t++)
+	{
+		workers.push_back(thread([&]()
+		{
+			char board[ROWS][COLS];
+			long wins[3] = { 0, 0, 0 };
+			unsigned long long sum = 0;
+			long first;
+
+			while((first = next.fetch_add(BATCH_CHUNK)) < games)
+			{
+				for(long i=first; i<first + BATCH_CHUNK && i<games; i++)
+				{
+					Random rng(seed,(unsigned long long)i);
+					sum += playRandomGame(rng,board,NULL);
+
+					int white = countPieces(board,'w');
+					int black = countPieces(board,'b');
+					wins[white > black ? 0 : (black > white ? 1 : 2)]++;
+				}
+			}
+
+			// adds the totals once, so the threads don't fight over them
+			whiteWins += wins[0];
+			blackWins += wins[1];
+			draws += wins[2];
+			checksum += sum;
+		}));
+	}
+	for(unsigned int t=0; t<workers.size(); t++)
+		workers[t].join();
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	cout << endl << "Played " << games << " games from seed " << seed << " on " << threads << " threads in "
+		 << seconds << " seconds (" << (seconds > 0 ? games / seconds : 0) << " games per second)" << endl;
+	cout << "White wins : " << whiteWins << "     Black wins : " << blackWins << "     Draws : " << draws << endl;
+	cout << "Checksum : " << hex << checksum.load() << dec << endl;
+}
+
+
+// replays game (game) of the batch started from (seed) and outputs its record and result
+// Parameters: (seed) - the master seed of the batch
+// (game) - the index of the game in the batch
+void replayGame(unsigned long long seed, long game)
+{
+	char board[ROWS][COLS];
+	string record;
+	Random rng(seed,(unsigned long long)game);
+
+	playRandomGame(rng,board,&record);
+	displayBoard(board);
+
+	cout << "White : " << countPieces(board,'w') << "     Black : " << countPieces(board,'b') << endl;
+	cout << "Game record : " << record << endl;
+}
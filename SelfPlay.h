@@ -0,0 +1,17 @@
+// SelfPlay.h - Othello self-play declaration
+// Written by Paul Jang
+
+#pragma once
+
+#include <string>
+#include "Othello.h"
+
+// plays one game of random AI moves, white first, the same way two computer players do
+// returns a hash of the moves played, and writes the game record if (record) is given
+unsigned long long playRandomGame(Random& rng, char gameBoard[ROWS][COLS], std::string* record);
+
+// plays (games) random games in parallel, game i seeded from (seed) and i, and outputs the totals
+void runSelfPlay(unsigned long long seed, long games);
+
+// replays game (game) of the batch started from (seed) and outputs its record and result
+void replayGame(unsigned long long seed, long game);
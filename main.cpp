@@ -4,485 +4,35 @@
 // including various necessary files
 #include <iostream>
 #include <vector>
-#include <math.h>
-#include "Player.h"
+#include <limits>
+#include <chrono>
+#include "Othello.h"
+#include "Search.h"
+#include "Renderer.h"
+#include "SelfPlay.h"
 
 using namespace std;
 
-#define ROWS	8	 // standard size for rows
-#define COLS	8	 // standard size for columns
 
-// initiates the game with an empty board and four pieces in the center
-// Parameter : (empty) - empty char array representing the game board
-void initiate(char empty[ROWS][COLS])
+// inputs a number, asking again until a valid one that isn't below the minimum is entered
+// a failed read is cleared and the rest of the line thrown away, so later inputs still work
+// Parameters: (value) - the number being inputted
+// (minimum) - the smallest number that is accepted
+template<typename T>
+void readNumber(T& value, T minimum)
 {
-	// nested for loops to traverse all coordinates
-	for(int i=0; i<ROWS; i++)
+	while(!(cin >> value) || value < minimum)
 	{
-		for(int j=0; j<COLS; j++)
+		// gives up with the minimum if there is nothing left to read
+		if(cin.eof())
 		{
-			empty[i][j] = '-';
+			value = minimum;
+			return;
 		}
-	}
-
-	// four pieces are always set at the beginning
-	empty[3][3] = empty[4][4] = 'w';
-	empty[3][4] = empty[4][3] = 'b';
-}
-
-
-// displays the current game board
-// Parameter : (gameBoard) - char array representing the game board
-void displayBoard(const char gameBoard[ROWS][COLS])	
-{
-	// spaces for neat formatting
-	cout << endl << "  ";
-	
-	// creates empty column spaces
-	for(int c=0; c<COLS; c++)
-	{
-		cout << c << " ";
-	}
-	cout << endl;
-
-	// traverses the board and adds appropriate spaces
-	for(int r=0; r<ROWS; r++)
-	{
-		cout << r << " ";
-		for(int c=0; c<COLS; c++)
-		{
-			cout << gameBoard[r][c] << ' ';
-		}
-		cout << endl;
-	}
-}
-
-
-// outputs a list of viable moves to be made
-// Parameters: (gameBoard) - char array representing the game board
-// (legalRows + legalCols) - vectors representing legal row values and legal column values
-// (disc) - char representing either white ('w') or black ('b')
-void listMoves(char gameBoard[ROWS][COLS], vector<int>& legalRows, vector<int>& legalCols, char disc)	
-{
-	int rowD=0;	 // row increment around the current square
-	int colD=0;	 // column increment around the current square
-	int row=0;	 // current row index
-	int col=0;	 // current column index
-	int x=0;	 // row index while searching
-	int y=0;	 // column index while searching
-	char opponent;	// opponent char
-
-	// assigns the opposite char as the opponent
-	if(disc == 'w')
-		opponent = 'b';
-	else
-		opponent = 'w';
-	
-	// traverses all rows and columns
-	for(row=0; row<ROWS; row++)
-	{
-		for(col=0; col<COLS; col++)
-		{
-			// goes ahead if the space is not empty
-			if(gameBoard[row][col] != '-')
-				continue;
-			// traverses all spaces around the current space
-			for(rowD = -1; rowD <= 1; rowD++)
-			{
-				for(colD = -1; colD <= 1; colD++)
-				{
-					// makes sure we don't go outside the gameboard
-					if(row+rowD <0 || row+rowD >= ROWS
-						|| col+colD<0 || col+colD >= COLS
-						|| (rowD == 0 && colD ==0))
-					{
-						continue;
-					}
-					
-					// if a space around the current space is an opponent piece
-					if((gameBoard[row+rowD][col+colD] == opponent))
-					{
-						// saves the x(row) and y(col) of the opposing space
-						x = row + rowD;
-						y = col + colD;
-						
-						// repeats
-						for(;;)
-						{
-							// adds the appropriate increment
-							x += rowD;
-							y += colD;
-
-							// breaks if we go outside the board
-							if(x<0 || x>=ROWS || y<0 || y>=COLS)
-								break;
-
-							// breaks if we hit an empty space
-							if(gameBoard[x][y] == '-')
-								break;
-
-							// adds the coordinates to the vectors if the space is a disc
-							// of the current player
-							if(gameBoard[x][y] == disc)
-							{
-								legalRows.push_back(row);
-								legalCols.push_back(col);
-								break;
-							}
-						}
-					}
-				}
-			}
-		}
-	}
 
-	// outputs a message if there are no viable moves
-	if(legalRows.size() == 0)
-	{
-		cout << "The current player does not have a viable move...";
-	}
-
-	// outputs the list of viable moves
-	else
-	{
-		cout << "The current player's viable moves are... " << endl;
-		for(unsigned int i=0; i<legalRows.size(); i++)
-		{
-			cout << "Row : " << legalRows[i] << "   Column : " << legalCols[i] << endl;
-		}
-	}
-}
-
-
-// outputs a list of viable moves to be made for the AI
-// exactly the same as listMoves but doesn't output the list of moves
-// Parameters: (gameBoard) - char array representing the game board
-// (legalRows + legalCols) - vectors representing legal row values and legal column values
-// (disc) - char representing either white or black
-void listMovesAI(char gameBoard[ROWS][COLS], vector<int>& legalRows, vector<int>& legalCols, char disc)	
-{
-	int rowD=0;	 // row increment around the current square
-	int colD=0;	 // column increment around the current square
-	int row=0;	 // current row index
-	int col=0;	 // current column index
-	int x=0;	 // row index while searching
-	int y=0;	 // column index while searching
-	char opponent;	// opponent char
-
-	if(disc == 'w')
-		opponent = 'b';
-	else
-		opponent = 'w';
-
-	for(row=0; row<ROWS; row++)
-	{
-		for(col=0; col<COLS; col++)
-		{
-			if(gameBoard[row][col] != '-')
-				continue;
-			for(rowD = -1; rowD <= 1; rowD++)
-			{
-				for(colD = -1; colD <= 1; colD++)
-				{
-					if(row+rowD <0 || row+rowD >= ROWS
-						|| col+colD<0 || col+colD >= COLS
-						|| (rowD == 0 && colD ==0))
-					{
-						continue;
-					}
-					if((gameBoard[row+rowD][col+colD] == opponent))
-					{
-						x = row + rowD;
-						y = col + colD;
-						for(;;)
-						{
-							x += rowD;
-							y += colD;
-							if(x<0 || x>=ROWS || y<0 || y>=COLS)
-								break;
-							if(gameBoard[x][y] == '-')
-								break;
-							if(gameBoard[x][y] == disc)
-							{
-								legalRows.push_back(row);
-								legalCols.push_back(col);
-								break;
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-	// *************************************************************
-	// since this is for the AI, displaying the moves is unnecessary
-	/*
-	if(legalRows.size() == 0)
-	{
-		cout << "The current player does not have a viable move...";
-	}
-	else
-	{
-		cout << "The current player's viable moves are... " << endl;
-		for(unsigned int i=0; i<legalRows.size(); i++)
-		{
-			cout << "Row : " << legalRows[i] << "   Column : " << legalCols[i] << endl;
-		}
-	}
-	*/
-}
-
-
-// takes a coordinate and changes the board accordingly
-// Parameters: (gameBoard) - char array representing the game board
-// (row + col) - coordinate representing where the piece will be placed
-// (color) - char representing the color of the piece being placed
-void flipDiscs(char gameBoard[ROWS][COLS], int& row, int& col, char color)
-{
-	int rowD = 0;	// row increment
-	int colD = 0;	// column increment
-	int x = 0;		// current row index
-	int y = 0;		// current column index
-	char opponent;	// opponent color
-
-	// assigns the opposing color
-	if(color == 'w')
-		opponent = 'b';
-	else
-		opponent = 'w';
-
-	// changes the actual coordinate to the appropriate game piece
-	gameBoard[row][col] = color;
-
-	// Check all squares around the current square for opponent pieces
-	for(rowD = -1; rowD <= 1; rowD++)
-	{
-		for(colD = -1; colD <= 1; colD++)
-		{
-			// continues only if we are still on the game board
-			if(row+rowD <0 || row+rowD >= ROWS || col+colD<0 || col+colD >= COLS
-				|| (rowD==0 && colD==0))
-				continue;
-
-			// keeps track if an opposing piece needs to be flipped
-			if(gameBoard[row+rowD][col+colD] == opponent)
-			{
-				x = row+rowD;
-				y = col+colD;
-			}
-
-			// repeats
-			for(;;)
-			{
-				// stores the appropriate coordinate
-				x += rowD;
-				y += colD;
-
-				// breaks if we go off the game board
-				if(x<0 || x>= ROWS || y<0 || y>= COLS)
-					break;
-
-				// breaks if the space is empty
-				if(gameBoard[x][y] == '-')
-					break;
-
-				if(gameBoard[x][y] == color)
-				{
-					// once we hit the next piece that is the same as the one being placed
-					// flips all the pieces that need to be flipped
-					while(gameBoard[x-=rowD][y-=colD] == opponent)
-						gameBoard[x][y] = color;
-					break;
-				}
-			}
-		}
-	}
-}
-
-
-// counts the current amount of pieces for either color
-// Parameters: (gameBoard) - char array representing the game board
-// (color) - char representing the color pieces that are being counted
-int countPieces(char gameBoard[ROWS][COLS], char color)
-{
-	// an int to keep track of the piece count
-	int totalPieces=0;
-
-	// traverses all the rows and columns
-	for(int r=0; r<ROWS; r++)
-	{
-		for(int c=0; c<COLS; c++)
-		{
-			// increments the piece count if the space is the appropriate color
-			if(gameBoard[r][c] == color)
-			{
-				totalPieces++;
-			}
-		}
-	}
-
-	// returns the count of pieces
-	return totalPieces;
-}
-
-
-// counts the total pieces currently on the board
-// Parameters: (gameBoard) - char array representing the game board
-int totalPieces(char gameBoard[ROWS][COLS])
-{
-	// an int to keep track of the total piece count
-	int pieces = 0;
-	
-	// traverses all the rows and columns
-	for(int r=0; r<ROWS; r++)
-	{
-		for(int c=0; c<COLS; c++)
-		{
-			// increments the count if the space is occupied by a piece
-			if((gameBoard[r][c] == 'w') || (gameBoard[r][c] == 'b'))
-				pieces++;
-		}
-	}
-
-	// returns the piece count
-	return pieces;
-}
-
-
-// gets a move from the AI
-// Parameters: (mover) - the player that is currently moving
-// (gameBoard) - char array representing the game board
-// (rows + cols) - vectors representing the list of valid rows and columns
-// (color) - char representing the color of the AI
-// (tracker) - an int to keep track of passes, so as to stop the game after so many passes
-void getAIMove(Player mover, char gameBoard[ROWS][COLS], vector<int>& rows, vector<int>& cols, char color, int& tracker)
-{
-	// an int to store an index
-	int index;
-
-	// list the available moves to the AI
-	listMovesAI(gameBoard,rows,cols,color);
-
-	// only continues if there are valid moves
-	if(rows.size() != 0)
-	{
-		// chooses a random index between 0 and the size of the array
-		index = rand() % rows.size();
-
-		// flips the appropriate discs
-		flipDiscs(gameBoard,rows[index],cols[index],color);
-
-		// outpus the message and the game board
-		cout << endl << "The computer has made its move." << endl;
-		displayBoard(gameBoard);
-
-		// resets the pass tracker
-		tracker = 0;
-	}
-
-	// if there are no valid moves
-	else
-	{
-		// outputs a message if the AI passes (has no moves)
-		cout << "The AI has passed their turn..." << endl;
-
-		// outputs the current game board
-		displayBoard(gameBoard);
-
-		// increments the pass tracker
-		tracker++;
-	}
-}
-
-
-// checks the move for validity
-// Parameters: (rows + cols) - vectors of rows and cols that are valid
-// (row + col) - the coordinate that needs to be checked
-bool checkMove(vector<int>& rows, vector<int>& cols, int& row, int& col)
-{
-	// traverses the entire vector
-	for(unsigned int i=0; i<rows.size(); i++)
-	{
-		if(rows[i] == row)
-		{
-			if(cols[i] == col)
-			{
-				// if the coordinate matches a certain coordinate in the vector
-				// returns true
-				return true;
-			}
-		}
-	}
-
-	// if there is no match in the vectors, returns false
-	return false;
-}
-
-
-// inputs a human move
-// Parameters: (gameBoard) - char array representing the game board
-// (rows + cols) - vectors of valid rows and columns
-// (row + col) - the coordinate passed as a reference
-// (color) - char representing the player's color
-// (tracker) - a tracker of the passes
-void getHumanMove(char gameBoard[ROWS][COLS], vector<int>& rows, vector<int>& cols,
-				  int& row, int& col, char color, int& tracker)
-{
-	// variables for convenience
-	char input; bool flag=true; char temp;
-
-	// outputs a list of viable moves
-	listMoves(gameBoard,rows,cols,color);
-
-	// while the flag bool is true
-	while(flag)
-	{
-		// inputs if the user wants to pass, or the row number
-		cout << "Above is a list of valid moves. " << endl << "Enter 'p' to pass, or enter the row number now : ";
-		cin >> input;
-
-		// if the user passes, triggers the flag, increments the tracker, and breaks the loop
-		if(input == 'p' || input == 'P')
-		{
-			cout << "You have chosen to pass...";
-			flag = false;
-			tracker++;
-			break;
-		}
-
-		// if the user doesn't pass
-		else
-		{
-			// creates an int from the char row input
-			row = input - '0';
-
-			// inputs the column number
-			cout << "Enter the column number now : ";
-			cin >> temp;
-
-			// creates an int from the char column input
-			col = temp - '0';
-		}
-
-		// if the move is not valid and the flag has not been triggered
-		// outputs a message to the user
-		if(checkMove(rows,cols,row,col) == false && flag)
-		{
-			cout << "Invalid move..." << endl;
-		}
-
-		// otherwise, if the move is valid and the flag has not been triggered
-		else if(flag)
-		{
-			// triggers the flag
-			flag = false;
-
-			// flips the appropriate discs
-			flipDiscs(gameBoard,row,col,color);
-
-			// resets the pass tracker
-			tracker = 0;
-		}
+		cin.clear();
+		cin.ignore(numeric_limits<streamsize>::max(),'\n');
+		cout << "Invalid number was inputted... Please enter a number of at least " << minimum << " : ";
 	}
 }
 
@@ -493,7 +43,12 @@ void main()
 	// variables for convenience
 	char input; bool inputLoop = true; char board[ROWS][COLS]; bool repeat = true; 
 	vector<int> legalRows; vector<int> legalCols; int track = 0; int pieces1 = 0; int pieces2 = 0;
-	int r1 = 0; int r2 = 0; int c1 = 0; int c2 = 0;
+	int r1 = 0; int r2 = 0; int c1 = 0; int c2 = 0; string record; double seconds = 0; char display; int interval = 0;
+	long games = 0; long replay = 0; long gameIndex = 0; unsigned long long batchSeed = 0;
+
+	// the master seed every game of this session is seeded from, together with its game number
+	unsigned long long seed = (unsigned long long)chrono::system_clock::now().time_since_epoch().count();
+	Random rng(seed);
 
 	// creating the player class for two players
 	Player P1 = Player('w',true); Player P2 = Player('b',true);
@@ -508,7 +63,9 @@ void main()
 			cout << endl << "Welcome to Othello!" << endl << endl;
 
 			// inputs how many AI/Humans are playing
-			cout << "For 2 AI enter '1'..." << endl << "For 2 Humans enter '2'..." << endl << "For 1 Human/1 AI enter '3' : ";
+			cout << "For 2 AI enter '1'..." << endl << "For 2 Humans enter '2'..." << endl << "For 1 Human/1 AI enter '3'..." << endl
+				 << "To analyze a recorded game enter '4'..." << endl
+				 << "To play a batch of random computer games enter '5' : ";
 			cin >> input;
 
 			// if there are two AI playing, changes the two players appropriately
@@ -535,6 +92,13 @@ void main()
 				inputLoop = false;
 			}
 
+			// if a game is being analyzed or a batch is played, no players are needed
+			// triggers the inputloop bool
+			else if(input == '4' || input == '5')
+			{
+				inputLoop = false;
+			}
+
 			// if the inputloop bool has not been triggered
 			else
 			{
@@ -545,12 +109,33 @@ void main()
 		// resets the inputloop bool
 		inputLoop = true;
 
-		// initiates the gameBoard
+		// initiates the gameBoard, the game record, and the random numbers of the game
 		initiate(board);
+		record.clear();
+		rng.setSeed(seed,gameIndex);
 
 		// if there are two AI playing
 		if(input == '1')
 		{
+			// asks how the boards should be shown while the computers play
+			cout << "To show every board enter 'f'..." << endl << "To update one board in place enter 'u'..." << endl
+				 << "To only show the final board enter 's' : ";
+			cin >> display;
+			if(display == 'u' || display == 'U')
+				getRenderer().setMode(BoardRenderer::IN_PLACE);
+			else if(display == 's' || display == 'S')
+				getRenderer().setMode(BoardRenderer::SKIP);
+			else
+				getRenderer().setMode(BoardRenderer::FULL_FRAMES);
+
+			// boards that come in faster than the interval are dropped, the final board is always shown
+			if(display != 's' && display != 'S')
+			{
+				cout << "Enter the least milliseconds between boards, or 0 to show every board : ";
+				readNumber(interval,0);
+				getRenderer().setThrottle(interval);
+			}
+
 			// displays each player's colors and the initial game board
 			cout << "Computer Player 1 -> White" << endl << "Computer Player 2 -> Black" << endl;
 			displayBoard(board);
@@ -559,28 +144,35 @@ void main()
 			while(totalPieces(board) < 64 && track < 3)
 			{
 				// gets the AI move from the Computer Player 1
-				getAIMove(P1,board,legalRows,legalCols,P1.getColor(),track);
+				getAIMove(P1,board,legalRows,legalCols,r1,c1,P1.getColor(),track,rng);
+				recordMove(record,r1,c1);
 
-				// outputs the current score
+				// outputs the current score, leaving the flushing to the board renderer
 				cout << "Computer Player 1 : " << countPieces(board, P1.getColor()) << "     " <<
-					"Computer Player 2 : " << countPieces(board,P2.getColor()) << endl << endl << "Computer Player 2's Turn... " << endl;
+					"Computer Player 2 : " << countPieces(board,P2.getColor()) << "\n\n" << "Computer Player 2's Turn... " << '\n';
 
 				// resets the vectors containing the valid rows and columns and redisplays the board
 				legalRows.clear(); legalCols.clear(); 
 				displayBoard(board);
 
 				// gets the AI move from the Computer Player 2
-				getAIMove(P2,board,legalRows,legalCols,P2.getColor(),track);
+				getAIMove(P2,board,legalRows,legalCols,r2,c2,P2.getColor(),track,rng);
+				recordMove(record,r2,c2);
 
-				// outputs the current score
+				// outputs the current score, leaving the flushing to the board renderer
 				cout << "Computer Player 1 : " << countPieces(board, P1.getColor()) << "     " <<
-					"Computer Player 2 : " << countPieces(board,P2.getColor()) << endl << endl << "Computer Player 1's Turn... " << endl;
+					"Computer Player 2 : " << countPieces(board,P2.getColor()) << "\n\n" << "Computer Player 1's Turn... " << '\n';
 
 				// resets the vectors containing the valid rows and columns and redisplays the board
 				legalRows.clear(); legalCols.clear();
 				displayBoard(board);
 			}
 
+			// shows the final board and goes back to printing every board
+			getRenderer().finish(board);
+			getRenderer().setMode(BoardRenderer::FULL_FRAMES);
+			getRenderer().setThrottle(0);
+
 			// after the game, sets variables to store each player's pieces
 			pieces1 = countPieces(board,P1.getColor());
 			pieces2 = countPieces(board,P2.getColor());
@@ -618,6 +210,7 @@ void main()
 
 				// gets the move from the human Player 1
 				getHumanMove(board,legalRows,legalCols,r1,c1,P1.getColor(),track);
+				recordMove(record,r1,c1);
 
 				// outputs the current score
 				cout << "Player 1 : " << countPieces(board,P1.getColor()) << "     " << 
@@ -630,6 +223,7 @@ void main()
 
 				// gets the move from the human Player 2
 				getHumanMove(board,legalRows,legalCols,r1,c1,P2.getColor(),track);
+				recordMove(record,r1,c1);
 
 				// outputs the current score and displays the current board
 				cout << "Player 1 : " << countPieces(board,P1.getColor()) << "     " << 
@@ -664,12 +258,14 @@ void main()
 				legalRows.clear(); legalCols.clear();
 				r1 = 0; r2 = 0; c1 = 0; c2 = 0;
 				getHumanMove(board,legalRows,legalCols,r1,c1,P1.getColor(),track);
+				recordMove(record,r1,c1);
 				cout << endl << "Player 1 : " << countPieces(board,P1.getColor()) << "     " << 
 					"Computer : " << countPieces(board,P2.getColor()) << endl << endl << "Computer's Turn... " << endl;
 				legalRows.clear(); legalCols.clear();
 				displayBoard(board);
 				r1 = 0; r2 = 0; c1 = 0; c2 = 0;
-				getAIMove(P2,board,legalRows,legalCols,P2.getColor(),track);
+				getAIMove(P2,board,legalRows,legalCols,r2,c2,P2.getColor(),track,rng);
+				recordMove(record,r2,c2);
 				cout << "Player 1 : " << countPieces(board,P1.getColor()) << "     " << 
 					"Computer : " << countPieces(board,P2.getColor()) << endl << endl << "Player 1's Turn... " << endl;
 				displayBoard(board);
@@ -690,6 +286,51 @@ void main()
 				cout << "The game has ended in a draw : " << pieces1 << " to " << pieces2 << ". ";
 			}
 		}
+
+		// analyzes a game record entered by the user
+		else if(input == '4')
+		{
+			cout << "Enter the game record, white moving first (row and column digits, 'p' to pass) : ";
+			cin >> ws;
+			getline(cin,record);
+			cout << "Enter the number of seconds to spend on each position : ";
+			readNumber(seconds,0.0);
+
+			analyzeGame(record,(int)(seconds * 1000),3);
+		}
+
+		// plays a batch of random games, and replays any one of them from the same seed
+		else if(input == '5')
+		{
+			cout << "Enter the master seed : ";
+			readNumber(batchSeed,0ULL);
+			cout << "Enter the number of games : ";
+			readNumber(games,0L);
+
+			runSelfPlay(batchSeed,games);
+
+			cout << "Enter a game number to replay, or -1 for none : ";
+			readNumber(replay,-1L);
+			if(replay >= 0)
+				replayGame(batchSeed,replay);
+		}
+
+		// outputs the moves of the game so it can be analyzed later
+		if(input != '4' && input != '5')
+		{
+			cout << endl << "Game record : " << record << endl;
+		}
+
+		// outputs where the random numbers of a computer-only game came from, so it can be replayed
+		// a game against a human can't be replayed, but still moves on to fresh random numbers
+		if(input == '1')
+		{
+			cout << "Master seed : " << seed << "     Game number : " << gameIndex << endl;
+		}
+		if(input == '1' || input == '3')
+		{
+			gameIndex++;
+		}
 		track = 0;
 		// asks the user if they want to play another game
 		cout << endl << "Would you like to play another game? (Y/N) : ";